@@ -3,18 +3,12 @@
 
 #include <iostream>
 #include <string>
+#include "PooledList.h"
 using namespace std;
 
-//Create the struct
-struct node {
-    char data;
-    node* next;
-};
-
-void printlist(node* head) {
-    while (head != nullptr) {
-        cout << head->data << " -> ";
-        head = head->next;
+void printlist(const PooledList<char>& list) {
+    for (char data : list) {
+        cout << data << " -> ";
     }
     cout << "null" << endl;
 }
@@ -26,34 +20,24 @@ int main() {
     // Create a string named myStr
     string myStr = "abcDefg";
 
-    //Test the struct
-    //Create a pointer named head
-    node* pHead = nullptr;
-
-    //Create a new node named Node
-    node* pNew = new node();
-    pNew->data = myStr[0];
-    pNew->next = nullptr;
-
-    //Output what is in our node
-    cout << "\nOutput of data and next: \n";
-    cout << pNew->data << endl;
-    cout << pNew->next << endl;
+    //Create an empty list
+    PooledList<char> list;
 
-    //Create our linked list
-    pHead = pNew;
+    //Add the first node to our linked list
+    list.pushFront(myStr[0]);
 
     //Verify this with output
-    cout << "\nOutput of the node that pHead is pointing to\n";
-    cout << pHead->data << endl;
-    cout << pHead->next << endl;
+    cout << "\nOutput of the node at the head of the list\n";
+    cout << list.front() << endl;
 
-    //Add a node to our linked list using our four steps
-    //Create a new node
-    pNew = new node();
-    pNew->data = myStr[1];
-    pNew->next =
+    //Add the rest of myStr to the front of our linked list
+    for (size_t i = 1; i < myStr.length(); i++) {
+        list.pushFront(myStr[i]);
+    }
 
+    //Output the whole list
+    cout << "\nOutput of the linked list\n";
+    printlist(list);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -1,42 +1,27 @@
 #include <iostream>
+#include "PooledList.h"
 using namespace std;
 
-struct Node {
-public:
-    char Data;
-    Node* pNext;
-};
-
-void printList(Node* head) {
-    while (head != nullptr) {
-        cout << head->Data << " -> ";
-        head = head->pNext;
+void printList(const PooledList<char>& list) {
+    for (char data : list) {
+        cout << data << " -> ";
     }
     cout << "null" << endl;
 }
 
 int main() {
-    Node* pHead = nullptr; // start with an empty list
+    PooledList<char> list; // start with an empty list
 
     // Insert 'a'
-    Node* pNew = new Node;
-    pNew->Data = 'a';
-    pNew->pNext = pHead;
-    pHead = pNew;
+    list.pushFront('a');
 
     // Insert 'b' at front
-    pNew = new Node;
-    pNew->Data = 'b';
-    pNew->pNext = pHead;
-    pHead = pNew;
+    list.pushFront('b');
 
     // Insert 'c' at front
-    pNew = new Node;
-    pNew->Data = 'c';
-    pNew->pNext = pHead;
-    pHead = pNew;
+    list.pushFront('c');
 
-    printList(pHead);
+    printList(list);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -4,17 +4,12 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include "PooledList.h"
 using namespace std;
 
-struct Node {
-    string Data;
-    Node* pNext;
-};
-
-void printlist(Node* head) {
-    while (head != nullptr) {
-        cout << head->Data << " -> ";
-        head = head->pNext;
+void printlist(const PooledList<string>& list) {
+    for (const string& data : list) {
+        cout << data << " -> ";
     }
     cout << "null" << endl;
 }
@@ -24,19 +19,13 @@ int main() {
     string myStrReversed = myStr;
     reverse(myStrReversed.begin(), myStrReversed.end());
 
-    Node* pHead = nullptr;
+    PooledList<string> list;
 
-    Node* pNew = new Node();
-    pNew->Data = myStr;
-    pNew->pNext = pHead;
-    pHead = pNew;
+    list.pushFront(myStr);
 
-    pNew = new Node();
-    pNew->Data = myStrReversed;
-    pNew->pNext = pHead;
-    pHead = pNew;
+    list.pushFront(myStrReversed);
 
-    printlist(pHead);
+    printlist(list);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,267 @@
+// Blake Wilson
+// Pooled Linked List
+
+#ifndef POOLEDLIST_H
+#define POOLEDLIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Hands out nodes from big slabs instead of calling new for every node.
+// Nodes that are given back go on a free list and get reused first.
+// Every slab is freed when the pool is destroyed, so nothing can leak.
+template <class Node>
+class NodePool {
+private:
+    // A spot in a slab. While a node is free, its memory holds the link to the next free spot.
+    union Spot {
+        Spot* nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    static_assert(sizeof(Spot) == sizeof(Node), "a run of spots must line up with an array of nodes");
+
+    static const size_t SLAB_NODES = 64;
+    std::vector<std::unique_ptr<Spot[]>> slabs;
+    Spot* freeList = nullptr;
+    size_t freeCount = 0;
+
+public:
+    NodePool() {}
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    // Gets memory for one node. The caller builds the node in it with placement new.
+    void* allocate() {
+        if (freeList == nullptr) {
+            slabs.emplace_back(new Spot[SLAB_NODES]);
+            Spot* slab = slabs.back().get();
+            for (size_t i = 0; i < SLAB_NODES; i++) {
+                slab[i].nextFree = freeList;
+                freeList = &slab[i];
+            }
+            freeCount += SLAB_NODES;
+        }
+        Spot* spot = freeList;
+        freeList = spot->nextFree;
+        freeCount--;
+        return spot->storage;
+    }
+
+    // Gets memory for count nodes in a row, all from one new slab.
+    // Nodes from a run are released one at a time like any other node.
+    void* allocateRun(size_t count) {
+        slabs.emplace_back(new Spot[count]);
+        return slabs.back().get();
+    }
+
+    // Gives a node's memory back so the next allocate() can reuse it.
+    void release(void* memory) {
+        Spot* spot = reinterpret_cast<Spot*>(memory);
+        spot->nextFree = freeList;
+        freeList = spot;
+        freeCount++;
+    }
+
+    // How many given back nodes are waiting to be reused
+    size_t available() const { return freeCount; }
+};
+
+// Picks how many items fit in a node of about two cache lines (at least one)
+template <class T>
+constexpr size_t defaultItemsPerNode() {
+    return (128 - 2 * sizeof(void*)) / sizeof(T) > 0 ? (128 - 2 * sizeof(void*)) / sizeof(T) : 1;
+}
+
+// Unrolled linked list: each node holds up to PerNode items next to each other,
+// so walking the list touches a fraction of the cache lines a one-item-per-node chain would.
+// Nodes come from the list's own NodePool and everything is freed in the destructor.
+template <class T, size_t PerNode = defaultItemsPerNode<T>()>
+class PooledList {
+private:
+    // One node: a link, the range of slots in use, and the slots themselves.
+    // Items are kept in slots first to last - 1, so both ends can grow without shifting anything.
+    struct Node {
+        Node* pNext;
+        unsigned short first;
+        unsigned short last;
+        alignas(T) unsigned char slots[PerNode * sizeof(T)];
+
+        T* item(size_t i) { return reinterpret_cast<T*>(slots) + i; }
+        const T* item(size_t i) const { return reinterpret_cast<const T*>(slots) + i; }
+    };
+
+    NodePool<Node> pool;
+    Node* pHead = nullptr;
+    Node* pTail = nullptr;
+    size_t count = 0;
+
+    // Makes an empty node in memory, with its free slots starting at spot
+    static Node* newNodeAt(void* memory, unsigned short spot) {
+        Node* node = new (memory) Node;
+        node->pNext = nullptr;
+        node->first = spot;
+        node->last = spot;
+        return node;
+    }
+
+    Node* newNode(unsigned short spot) { return newNodeAt(pool.allocate(), spot); }
+
+public:
+    // Walks the items in list order, one node at a time
+    class const_iterator {
+    private:
+        const Node* node;
+        size_t spot;
+
+    public:
+        const_iterator(const Node* startNode, size_t startSpot) : node(startNode), spot(startSpot) {}
+
+        const T& operator*() const { return *node->item(spot); }
+        const T* operator->() const { return node->item(spot); }
+
+        const_iterator& operator++() {
+            spot++;
+            if (spot == node->last) {
+                node = node->pNext;
+                spot = node != nullptr ? node->first : 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const const_iterator& other) const { return node == other.node && spot == other.spot; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+    };
+
+    PooledList() {}
+
+    // Builds the list from a range, like a string_view, in the range's order
+    template <class Range>
+    explicit PooledList(const Range& range) { assign(range); }
+
+    template <class Iter>
+    PooledList(Iter first, Iter last) { assign(first, last); }
+
+    ~PooledList() { clear(); }
+
+    PooledList(const PooledList&) = delete;
+    PooledList& operator=(const PooledList&) = delete;
+
+    // Replaces the list with the items from first to last.
+    // Nodes the pool already has free are used first, including the ones clear() just gave back,
+    // so assigning again and again never grows the pool. Only the nodes still missing come from one new block,
+    // and everything is linked in a single pass instead of one allocation per item.
+    template <class Iter>
+    void assign(Iter first, Iter last) {
+        clear();
+        size_t total = static_cast<size_t>(std::distance(first, last));
+        if (total == 0) {
+            return;
+        }
+        size_t nodeCount = (total + PerNode - 1) / PerNode;
+        size_t reused = std::min(nodeCount, pool.available());
+        Node* block = nullptr;
+        if (nodeCount > reused) {
+            block = reinterpret_cast<Node*>(pool.allocateRun(nodeCount - reused));
+        }
+        size_t left = total;
+        for (size_t i = 0; i < nodeCount; i++) {
+            Node* node = newNodeAt(i < reused ? pool.allocate() : &block[i - reused], 0);
+            if (pTail != nullptr) {
+                pTail->pNext = node;
+            } else {
+                pHead = node;
+            }
+            pTail = node;
+            for (; node->last < PerNode && left > 0; ++first, left--) {
+                new (node->item(node->last)) T(*first);
+                node->last++;
+                count++;
+            }
+        }
+    }
+
+    template <class Range>
+    void assign(const Range& range) { assign(std::begin(range), std::end(range)); }
+
+    // Adds an item to the front of the list, like pNew->pNext = pHead; pHead = pNew;
+    void pushFront(const T& value) {
+        if (pHead == nullptr || pHead->first == 0) {
+            Node* node = newNode(static_cast<unsigned short>(PerNode));
+            node->pNext = pHead;
+            pHead = node;
+            if (pTail == nullptr) {
+                pTail = node;
+            }
+        }
+        new (pHead->item(pHead->first - 1)) T(value);
+        pHead->first--;
+        count++;
+    }
+
+    // Adds an item to the end of the list
+    void pushBack(const T& value) {
+        if (pTail == nullptr || pTail->last == PerNode) {
+            Node* node = newNode(0);
+            if (pTail != nullptr) {
+                pTail->pNext = node;
+            } else {
+                pHead = node;
+            }
+            pTail = node;
+        }
+        new (pTail->item(pTail->last)) T(value);
+        pTail->last++;
+        count++;
+    }
+
+    // Removes the first item. Empty nodes go back to the pool right away.
+    void popFront() {
+        if (pHead == nullptr) {
+            return;
+        }
+        pHead->item(pHead->first)->~T();
+        pHead->first++;
+        count--;
+        if (pHead->first == pHead->last) {
+            Node* old = pHead;
+            pHead = pHead->pNext;
+            if (pHead == nullptr) {
+                pTail = nullptr;
+            }
+            old->~Node();
+            pool.release(old);
+        }
+    }
+
+    const T& front() const { return *pHead->item(pHead->first); }
+    bool empty() const { return pHead == nullptr; }
+
+    // The number of items, kept up to date so nothing has to walk the list
+    size_t size() const { return count; }
+
+    // Destroys every item and hands every node back to the pool
+    void clear() {
+        while (pHead != nullptr) {
+            Node* node = pHead;
+            for (size_t i = node->first; i < node->last; i++) {
+                node->item(i)->~T();
+            }
+            pHead = node->pNext;
+            node->~Node();
+            pool.release(node);
+        }
+        pTail = nullptr;
+        count = 0;
+    }
+
+    const_iterator begin() const { return const_iterator(pHead, pHead != nullptr ? pHead->first : 0); }
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+};
+
+#endif
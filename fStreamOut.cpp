@@ -1,35 +1,364 @@
 #include <iostream>
-#include <fstream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <cerrno>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 using namespace std;
 
-int main() {
-    fstream myFile;
-    myFile.open("blake.txt", ios::out); //write
-    if (myFile.is_open()) {
-        myFile << "Hello\n";
-        myFile << "This is second line\n";
-        myFile.close();
+// Log file that stays open and only ever gets added to. Each record is one line.
+// Writers drop their records into a shared batch, and one committer thread writes the whole batch
+// in a single write (and a single fsync when that is asked for), so many writers share one disk trip.
+class AppendLog {
+public:
+    // How far a record has to get before append() returns.
+    // NO_WAIT returns right away, WRITTEN waits until the record has been handed to the system,
+    // and SYNCED waits until the system says it is on the disk.
+    enum Durability { NO_WAIT, WRITTEN, SYNCED };
+
+private:
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+#else
+    int fileDescriptor = -1;
+#endif
+    Durability durability;
+    string pending;
+    string writing;
+    uint64_t queuedEnd = 0;
+    uint64_t writtenEnd = 0;
+    uint64_t syncedEnd = 0;
+    uint64_t syncWanted = 0;
+    bool stopping = false;
+    bool failed = false;
+    mutex lock;
+    condition_variable changed;
+    thread committer;
+
+    // Writes all of text to the end of the file
+    bool writeAll(const string &text) {
+        size_t done = 0;
+        while (done < text.size()) {
+#ifdef _WIN32
+            DWORD written = 0;
+            DWORD chunk = static_cast<DWORD>(min<size_t>(text.size() - done, 1 << 30));
+            if (!WriteFile(fileHandle, text.data() + done, chunk, &written, nullptr)) {
+                return false;
+            }
+#else
+            ssize_t written = write(fileDescriptor, text.data() + done, text.size() - done);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+#endif
+            done += static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    // Asks the system to put everything written so far on the disk
+    bool syncFile() {
+#ifdef _WIN32
+        return FlushFileBuffers(fileHandle) != 0;
+#else
+        return fsync(fileDescriptor) == 0;
+#endif
+    }
+
+    // The committer loop: take the whole batch, write it in one go, then wake everyone it covered.
+    // The batch is also flushed to the disk when the log is SYNCED or someone has called sync().
+    // The lock is never held during a write or a flush, so appends keep batching up meanwhile.
+    void commitLoop() {
+        unique_lock<mutex> guard(lock);
+        while (true) {
+            changed.wait(guard, [&]() { return stopping || !pending.empty() || syncWanted > syncedEnd; });
+            if (pending.empty() && syncWanted <= syncedEnd) {
+                return;
+            }
+            writing.swap(pending);
+            uint64_t batchEnd = queuedEnd;
+            bool flush = durability == SYNCED || syncWanted > syncedEnd;
+            guard.unlock();
+
+            bool ok = writeAll(writing);
+            if (ok && flush) {
+                ok = syncFile();
+            }
+            writing.clear();
+
+            guard.lock();
+            failed = failed || !ok;
+            writtenEnd = batchEnd;
+            if (flush) {
+                syncedEnd = batchEnd;
+            }
+            changed.notify_all();
+        }
+    }
+
+public:
+    // Opens the log for adding to, making it if it is not there.
+    // startFresh empties it first, the way ios::out does.
+    explicit AppendLog(const string &fileName, Durability newDurability = WRITTEN, bool startFresh = false)
+        : durability(newDurability) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(fileName.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                 startFresh ? CREATE_ALWAYS : OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            return;
+        }
+#else
+        fileDescriptor = open(fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND | (startFresh ? O_TRUNC : 0), 0644);
+        if (fileDescriptor < 0) {
+            return;
+        }
+#endif
+        committer = thread(&AppendLog::commitLoop, this);
     }
 
-    myFile.open("blake.txt", ios::app); //append
-    if (myFile.is_open()) {
-        myFile << "Hello2\n";
-        myFile.close();
+    // Writes out whatever is still waiting, then closes the file
+    ~AppendLog() {
+        if (committer.joinable()) {
+            {
+                lock_guard<mutex> guard(lock);
+                stopping = true;
+            }
+            changed.notify_all();
+            committer.join();
+        }
+#ifdef _WIN32
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (fileDescriptor >= 0) {
+            close(fileDescriptor);
+        }
+#endif
     }
 
-    myFile.open("blake.txt", ios::in); //read
-    if (myFile.is_open()) {
-        string line;
-        while (getline(myFile, line)) {
-            cout << line << endl;
+    AppendLog(const AppendLog &) = delete;
+    AppendLog &operator=(const AppendLog &) = delete;
+
+    bool isOpen() const { return committer.joinable(); }
+
+    // Adds one record as a line at the end of the log. Safe to call from many threads at once.
+    // Returns false if the log could not be opened or a write has failed.
+    bool append(string_view record) {
+        if (!isOpen()) {
+            return false;
         }
-        myFile.close();
+        unique_lock<mutex> guard(lock);
+        pending.append(record.data(), record.size());
+        pending += '\n';
+        queuedEnd += record.size() + 1;
+        uint64_t recordEnd = queuedEnd;
+        changed.notify_all();
+        if (durability == NO_WAIT) {
+            return !failed;
+        }
+        const uint64_t &reached = (durability == SYNCED) ? syncedEnd : writtenEnd;
+        changed.wait(guard, [&]() { return failed || reached >= recordEnd; });
+        return !failed;
     }
 
+    // Waits until every record added so far is on the disk, whatever the durability level is.
+    // It asks the committer for the flush and waits the way a SYNCED append does, so nobody is locked out meanwhile.
+    bool sync() {
+        if (!isOpen()) {
+            return false;
+        }
+        unique_lock<mutex> guard(lock);
+        uint64_t target = queuedEnd;
+        if (syncedEnd < target) {
+            syncWanted = max(syncWanted, target);
+            changed.notify_all();
+        }
+        changed.wait(guard, [&]() { return failed || syncedEnd >= target; });
+        return !failed;
+    }
+};
+
+// Reader that follows a log as it grows, through a shared read only mapping of the file.
+// It keeps its place, so each call to next() only looks at records added since the last one,
+// instead of reopening the file and reading it again from the start.
+class LogTail {
+private:
+    const char *data = nullptr;
+    size_t mappedSize = 0;
+    size_t fileSize = 0;
+    size_t offset = 0;
+#ifdef _WIN32
+    HANDLE fileHandle = INVALID_HANDLE_VALUE;
+    HANDLE mappingHandle = nullptr;
+#else
+    int fileDescriptor = -1;
+#endif
+
+    void unmap() {
+#ifdef _WIN32
+        if (data != nullptr) {
+            UnmapViewOfFile(data);
+        }
+        if (mappingHandle != nullptr) {
+            CloseHandle(mappingHandle);
+            mappingHandle = nullptr;
+        }
+#else
+        if (data != nullptr) {
+            munmap(const_cast<char *>(data), mappedSize);
+        }
+#endif
+        data = nullptr;
+        mappedSize = 0;
+    }
+
+    // Checks how big the file is now and maps it again if it has outgrown the current mapping.
+    // On POSIX the mapping is made bigger than the file, so most growth needs no new mapping at all.
+    // Pages past the end of the file must never be touched (on POSIX that raises SIGBUS), so every read is
+    // held to the size seen here. If the file got shorter, it was started fresh, so the tail goes back to
+    // the start and maps it again. If the size cannot be checked, nothing past the current place is read.
+    // A log cut short by another process in the moment between this check and the read can still fault,
+    // which is why a tail should be opened after any writer that starts the log fresh, as main does.
+    void refresh() {
+#ifdef _WIN32
+        LARGE_INTEGER size;
+        if (fileHandle == INVALID_HANDLE_VALUE || !GetFileSizeEx(fileHandle, &size)) {
+            fileSize = min(fileSize, offset);
+            return;
+        }
+        fileSize = static_cast<size_t>(size.QuadPart);
+#else
+        struct stat fileInfo;
+        if (fileDescriptor < 0 || fstat(fileDescriptor, &fileInfo) != 0) {
+            fileSize = min(fileSize, offset);
+            return;
+        }
+        fileSize = static_cast<size_t>(fileInfo.st_size);
+#endif
+        bool shrunk = fileSize < offset;
+        if (shrunk) {
+            offset = 0;
+        }
+        if (!shrunk && (fileSize <= mappedSize || fileSize == 0)) {
+            return;
+        }
+        unmap();
+        if (fileSize == 0) {
+            return;
+        }
+#ifdef _WIN32
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr) {
+            data = static_cast<const char *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            mappedSize = data != nullptr ? fileSize : 0;
+        }
+#else
+        size_t window = max<size_t>(fileSize * 2, 1 << 20);
+        void *mapped = mmap(nullptr, window, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        if (mapped != MAP_FAILED) {
+            data = static_cast<const char *>(mapped);
+            mappedSize = window;
+        }
+#endif
+    }
+
+public:
+    explicit LogTail(const string &fileName) {
+#ifdef _WIN32
+        fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        fileDescriptor = open(fileName.c_str(), O_RDONLY);
+#endif
+        refresh();
+    }
+
+    ~LogTail() {
+        unmap();
+#ifdef _WIN32
+        if (fileHandle != INVALID_HANDLE_VALUE) {
+            CloseHandle(fileHandle);
+        }
+#else
+        if (fileDescriptor >= 0) {
+            close(fileDescriptor);
+        }
+#endif
+    }
+
+    LogTail(const LogTail &) = delete;
+    LogTail &operator=(const LogTail &) = delete;
+
+#ifdef _WIN32
+    bool isOpen() const { return fileHandle != INVALID_HANDLE_VALUE; }
+#else
+    bool isOpen() const { return fileDescriptor >= 0; }
+#endif
+
+    // Hands out the next complete record added since the last call, without the newline.
+    // Returns false when there is nothing new yet. A line still being written is left for later.
+    // The size is checked again first, so a log that was cut short is never read past its new end.
+    // The record points into the mapping and stays good until the next call or until the log is started fresh.
+    bool next(string_view &record) {
+        refresh();
+        if (data == nullptr || offset >= fileSize) {
+            return false;
+        }
+        const char *start = data + offset;
+        const void *newline = memchr(start, '\n', fileSize - offset);
+        if (newline == nullptr) {
+            return false;
+        }
+        size_t length = static_cast<size_t>(static_cast<const char *>(newline) - start);
+        record = string_view(start, length);
+        offset += length + 1;
+        return true;
+    }
+};
+
+// Prints every record the tail has not shown yet
+void printNewRecords(LogTail &tail) {
+    string_view record;
+    while (tail.next(record)) {
+        cout << record << endl;
+    }
+}
+
+int main() {
+    AppendLog log("blake.txt", AppendLog::SYNCED, true); //one handle for every write, starting fresh
+    LogTail tail("blake.txt"); //one reader that follows the log as it grows
+
+    log.append("Hello");
+    log.append("This is second line");
+    printNewRecords(tail); //read what was written so far
+
+    log.append("Hello2"); //append without reopening
+    printNewRecords(tail); //only the new line is read, not the whole file again
+
     //Test to see if file was actually created.
-    if (myFile) {
+    if (log.isOpen() && tail.isOpen()) {
         cout << "\nFile blake.txt successfully created in the cmake-build-debug folder.\n";
     }
 
+#ifdef _WIN32
     system("pause>0");
-}
\ No newline at end of file
+#endif
+}
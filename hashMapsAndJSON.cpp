@@ -1,10 +1,144 @@
 #include <iostream>
 #include <C:/Users/bwils/CLionProjects/Beginner Projects/hashMapsAndJSON/include/json.hpp.txt>
 #include <string>
-#include <unordered_map>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <cstdint>
 using json = nlohmann::json;
 using namespace std;
 
+// Score table keyed by student name.
+// Names are kept back to back in one string and entries sit in one vector in the order they were added,
+// so walking the roster is a straight pass in a fixed order. Lookups go through a flat open addressing
+// table of entry numbers, and a size hint sets everything up once so loading never rehashes.
+// The scores themselves live in a deque, which never moves what it already holds, so a reference from
+// operator[] stays good when more names are added, just like with unordered_map.
+class Roster {
+private:
+    struct Entry {
+        uint32_t keyStart;
+        uint32_t keyLength;
+    };
+
+    string keyText;
+    vector<Entry> entries;
+    deque<int> values;        // score of entry number i, in the same order as entries
+    vector<uint32_t> slots;   // entry number + 1, or 0 for an empty slot
+    size_t mask = 0;
+
+    // FNV-1a hash of a name
+    static size_t hashKey(string_view key) {
+        uint64_t hashValue = 14695981039346656037ULL;
+        for (char letter : key) {
+            hashValue = (hashValue ^ static_cast<unsigned char>(letter)) * 1099511628211ULL;
+        }
+        return static_cast<size_t>(hashValue ^ (hashValue >> 32));
+    }
+
+    string_view keyOf(const Entry &entry) const {
+        return string_view(keyText).substr(entry.keyStart, entry.keyLength);
+    }
+
+    // Finds the slot holding key, or the empty slot where it would go
+    size_t findSlot(string_view key) const {
+        size_t i = hashKey(key) & mask;
+        while (slots[i] != 0 && keyOf(entries[slots[i] - 1]) != key) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    // Rebuilds the slot table with room for at least expected names at under 3/4 full
+    void rehash(size_t expected) {
+        size_t capacity = 16;
+        while (capacity * 3 < expected * 4 + 4) {
+            capacity *= 2;
+        }
+        slots.assign(capacity, 0);
+        mask = capacity - 1;
+        for (size_t e = 0; e < entries.size(); e++) {
+            slots[findSlot(keyOf(entries[e]))] = static_cast<uint32_t>(e + 1);
+        }
+    }
+
+public:
+    explicit Roster(size_t expected = 0) { reserve(expected); }
+
+    // Makes room for expected names, and keyBytes characters of names, all at once
+    void reserve(size_t expected, size_t keyBytes = 0) {
+        entries.reserve(expected);
+        keyText.reserve(keyBytes);
+        if (slots.empty() || (expected + 1) * 4 > slots.size() * 3) {
+            rehash(expected);
+        }
+    }
+
+    // Gets the score for a name, adding the name with a score of 0 the first time, like unordered_map does
+    int &operator[](string_view key) {
+        size_t i = findSlot(key);
+        if (slots[i] == 0) {
+            if ((entries.size() + 2) * 4 > slots.size() * 3) {
+                rehash(entries.size() * 2 + 2);
+                i = findSlot(key);
+            }
+            entries.push_back(Entry{static_cast<uint32_t>(keyText.size()), static_cast<uint32_t>(key.size())});
+            values.push_back(0);
+            keyText.append(key.data(), key.size());
+            slots[i] = static_cast<uint32_t>(entries.size());
+        }
+        return values[slots[i] - 1];
+    }
+
+    // Finds the score for a name without adding it, or nullptr if the name is not in the roster
+    const int *find(string_view key) const {
+        if (slots.empty()) {
+            return nullptr;
+        }
+        size_t i = findSlot(key);
+        return slots[i] == 0 ? nullptr : &values[slots[i] - 1];
+    }
+
+    // Loads every name : score pair of a JSON object. The whole object is measured first,
+    // so the names, the entries, and the slot table are each allocated once.
+    void load(const json &object) {
+        size_t keyBytes = keyText.size();
+        for (auto &item : object.items()) {
+            keyBytes += item.key().size();
+        }
+        reserve(entries.size() + object.size(), keyBytes);
+        for (auto &item : object.items()) {
+            (*this)[item.key()] = item.value().template get<int>();
+        }
+    }
+
+    size_t size() const { return entries.size(); }
+
+    // Walks the roster in the order names were added, handing out name/score pairs
+    class const_iterator {
+    private:
+        const Roster *roster;
+        size_t spot;
+
+    public:
+        const_iterator(const Roster *newRoster, size_t newSpot) : roster(newRoster), spot(newSpot) {}
+
+        pair<string_view, int> operator*() const {
+            return pair<string_view, int>(roster->keyOf(roster->entries[spot]), roster->values[spot]);
+        }
+
+        const_iterator &operator++() {
+            spot++;
+            return *this;
+        }
+
+        bool operator!=(const const_iterator &other) const { return spot != other.spot; }
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, entries.size()); }
+};
+
 int main() {
     cout << "\nWelcome to JSON!\n" << endl;
 
@@ -14,14 +148,18 @@ int main() {
         {"Chase", 4321}
     };
 
+    // Load the JSON object into a roster once, so every lookup after that is a flat hash probe
+    Roster myStuIds;
+    myStuIds.load(myStuList);
+
     // Access the values like a hash map
-    cout << "Arturo's Student ID: " << myStuList["Arturo"] << " (this is the value of the key/value pair)" << endl;
-    cout << "Blake's Student ID: " << myStuList["Blake"] << endl;
-    cout << "Chase's Student ID: " << myStuList["Chase"] << endl;
+    cout << "Arturo's Student ID: " << myStuIds["Arturo"] << " (this is the value of the key/value pair)" << endl;
+    cout << "Blake's Student ID: " << myStuIds["Blake"] << endl;
+    cout << "Chase's Student ID: " << myStuIds["Chase"] << endl;
 
-    /* Create a C++ hash map that uses three student names as keys and int values for
-     * their test scores - name(string) : score(int) */
-    unordered_map<string, int>myStuTestScores;
+    /* Create a roster that uses three student names as keys and int values for
+     * their test scores - name(string) : score(int). The 3 is a size hint, so it never rehashes */
+    Roster myStuTestScores(3);
 
     myStuTestScores["Arturo"] = 95;
     myStuTestScores["Blake"] = 100;
@@ -32,8 +170,8 @@ int main() {
     cout << "Chase's test score is: " << myStuTestScores["Chase"] << endl;
     cout << "\n";
 
-    // Loop through the hash map with a C++ programming idiom
-    for (auto &pair : myStuTestScores) {
+    // Loop through the roster with a C++ programming idiom. It always goes in the order the names were added
+    for (auto pair : myStuTestScores) {
         cout << pair.first << ": " << pair.second << endl;
     }
 
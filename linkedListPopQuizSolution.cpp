@@ -3,14 +3,10 @@
 
 #include <iostream>
 #include <string>
+#include "PooledList.h"
 
 using namespace std;
 
-struct node {
-    char data;
-    node* next;
-};
-
 int main() {
 
     cout << "\n    *********** Hello and welcome to the linked list pop quiz! *****************\n";
@@ -25,9 +21,8 @@ int main() {
     cout << "\n myStr[2] is: " << myStr[2] << endl;
 
 
-    // Create two pointers
-    node* pHead = nullptr;
-    node* pCurrent = nullptr;
+    // Create an empty list
+    PooledList<char> list;
 
     // Linked List Steps
     // 1) Create a new node
@@ -36,36 +31,16 @@ int main() {
     // 4) Reposition head of list pointer
 
     // Boundary Condition: The start of the list/
-    pHead = new node();
-    pHead->data = myStr[0];
-    pHead->next = nullptr;
+    list.pushFront(myStr[0]);
 
     // Create two more nodes
-
-    // This is the second node in our list.
-    // Step 1: Create a new node
-    pCurrent = new node();
-    // Step 2: Fill the data field(s)
-    pCurrent->data = myStr[1];
-    // Step 3: Attach to head of list
-    pCurrent->next = pHead;
-    // Step 4: Reposition head of list
-    pHead = pCurrent;
-
-    // This is the second node in our list.
-    // Step 1: Create a new node
-    pCurrent = new node();
-    // Step 2: Fill the data field(s)
-    pCurrent->data = myStr[2];
-    // Step 3: Attach to head of list
-    pCurrent->next = pHead;
-    // Step 4: Reposition head of list
-    pHead = pCurrent;
+    list.pushFront(myStr[1]);
+    list.pushFront(myStr[2]);
 
     // Output the linked list.
-    cout << "\n Linked list data: " << pHead->data << endl;
-    cout << "\n Linked list data: " << pHead->next->data << endl;
-    cout << "\n Linked list data: " << pHead->next->next->data << endl;
+    for (char data : list) {
+        cout << "\n Linked list data: " << data << endl;
+    }
 
     // Use a for loop to build a linked list of all chars in myStr
 
@@ -75,65 +50,47 @@ int main() {
 
     // What is wrong with this code?
     // Why does it not fail?
-    for (int i=0; i<100; i++) {
-        new node;
+    {
+        PooledList<char> scratch;
+        for (int i=0; i<100; i++) {
+            scratch.pushFront('\0');
+        }
     }
 
     // What does this code do?
     // Is this proper C++ programming?
+    PooledList<char> queue;
     for (int i = 0; i < 7; i++) {
-        node* myNode = new node;
-        myNode->data = myStr[i];
-        cout << "\n Linked list data: " << myNode->data << endl;
-        delete myNode;
+        queue.pushBack(myStr[i]);
+        cout << "\n Linked list data: " << queue.front() << endl;
+        queue.popFront();
     }
 
 
-    // Create the linked list using a for loop
+    // Create the linked list from all of myStr at once
 
-    // We must have a starting node outside the for loop.
-    // Boundary Condition: The start of the list
-
-    // Note: pHead and pCurrent are already node pointers, we do not redefine them here
-    // What would happen if you did this:
-    // node* pHead = new node();
-
-    pHead = new node();
-    pHead->data = myStr[0];
-    pHead->next = nullptr;
-
-    for (int i = 0; i < 7; i++) {
-        // Step 1: Create a new node
-        pCurrent = new node();
-        // Step 2: Fill the data field(s)
-        pCurrent->data = myStr[i];
-        // Step 3: Attach to head of list
-        pCurrent->next = pHead;
-        // Step 4: Reposition head of list
-        pHead = pCurrent;
-    }
+    // The old version started with myStr[0] and then added all 7 chars at the head,
+    // so the list is myStr[0] followed by myStr reversed. assign builds it from one block.
+    string reversedStr(myStr.rbegin(), myStr.rend());
+    list.assign(reversedStr + myStr[0]);
 
     // Output the linked list!
     // Ensure pHead and pCurrent are both pointing to the head of the list
-    cout << "\n pHead's data: " << pHead->data << endl;
-    cout << "\n pCurrent's data: " << pCurrent->data << endl;
+    PooledList<char>::const_iterator pHead = list.begin();
+    PooledList<char>::const_iterator pCurrent = list.begin();
+    cout << "\n pHead's data: " << *pHead << endl;
+    cout << "\n pCurrent's data: " << *pCurrent << endl;
 
-    // Use a while loop to get the size of the list
-    // Remember: the loop control variable must be initialized, checked, and changed.
+    // Get the size of the list
+    // The list keeps its own size. Walking until pCurrent->next == nullptr missed the last node.
     int sizeOfList = 0;
     cout << "\n Size of list: " << sizeOfList << endl;
-    while (pCurrent->next != nullptr) {
-        sizeOfList++;
-        pCurrent = pCurrent->next;
-    }
+    sizeOfList = static_cast<int>(list.size());
     cout << "\n Size of list: " << sizeOfList << endl;
 
-    // Get pCurrent back to the head of the list
-    pCurrent = pHead;
-
     for (int i = 0; i < sizeOfList; i++) {
-        cout << "\n pCurrent's data: " << pCurrent->data << endl;
-        pCurrent = pCurrent->next;
+        cout << "\n pCurrent's data: " << *pCurrent << endl;
+        ++pCurrent;
     }
 
     // Get pCurrent back to the head of the list to do more linked-list stuff!
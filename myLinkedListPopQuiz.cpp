@@ -3,14 +3,10 @@
 
 #include <iostream>
 #include <string>
+#include "PooledList.h"
 
 using namespace std;
 
-struct node {
-    char data;
-    node* next;
-};
-
 int main() {
     cout << "\n    *********** Hello and welcome to the linked list pop quiz! *****************\n";
 
@@ -24,9 +20,8 @@ int main() {
     cout << "\nmyStr[2] is: " << myStr[2] << endl;
 
 
-    // Create two pointers
-    node* pHead = nullptr;
-    node* pCurrent = nullptr;
+    // Create an empty list. Its nodes come from the list's own pool and are freed when it goes out of scope.
+    PooledList<char> list;
 
     // Linked List Steps
     // 1) Create a new node
@@ -34,37 +29,17 @@ int main() {
     // 3) Attach the node to the head of list
     // 4) Reposition head of list pointer
 
-    // Boundary Condition: The start of the list/
-    pHead = new node();
-    pHead->data = myStr[0];
-    pHead->next = nullptr;
+    // pushFront does all four steps, and packs several chars into each node
+    list.pushFront(myStr[0]);
 
     // Create two more nodes
-
-    // This is the second node in our list.
-    // Step 1: Create a new node
-    pCurrent = new node();
-    // Step 2: Fill the data field(s)
-    pCurrent->data = myStr[1];
-    // Step 3: Attach to head of list
-    pCurrent->next = pHead;
-    // Step 4: Reposition head of list
-    pHead = pCurrent;
-
-    // This is the third node in our list.
-    // Step 1: Create a new node
-    pCurrent = new node();
-    // Step 2: Fill the data field(s)
-    pCurrent->data = myStr[2];
-    // Step 3: Attach to head of list
-    pCurrent->next = pHead;
-    // Step 4: Reposition head of list
-    pHead = pCurrent;
+    list.pushFront(myStr[1]);
+    list.pushFront(myStr[2]);
 
     // Output the linked list.
-    cout << "\nLinked list data: " << pHead->data << endl;
-    cout << "\nLinked list data: " << pHead->next->data << endl;
-    cout << "\nLinked list data: " << pHead->next->next->data << endl;
+    for (char data : list) {
+        cout << "\nLinked list data: " << data << endl;
+    }
 
     // Use a for loop to build a linked list of all chars in myStr
 
@@ -73,77 +48,54 @@ int main() {
     cout << "\nmyStr length is: " << myStr.length() << endl;
 
 
-    // What is wrong with this code? It creates 100 new nodes with nothing stored in them, wasting memory.
-    // Why does it not fail? The code, although not code you'd want to put in your linked list program, is written in correct syntax and will run anyway.
-    // TODO: Discuss with your lab partner, be ready to answer your professor's questions about memory management
-    for (int i=0; i<100; i++) {
-        new node;
+    // What was wrong with the old code? It created 100 new nodes with nothing stored in them and never deleted them, leaking memory.
+    // Why did it not fail? The code was written in correct syntax, and leaked memory is only given back when the program ends.
+    // Now the 100 items go into a scratch list whose pool frees them when the block ends.
+    {
+        PooledList<char> scratch;
+        for (int i=0; i<100; i++) {
+            scratch.pushFront('\0');
+        }
     }
 
-    /* What does this code do? This code creates a new node each iteration, stores the character from myStr[i] in it, prints it, and then deletes it.
-     * It does not actually form a linked list because the nodes are destroyed right after being printed.*/
-    // Is this proper C++ programming? Not really, you usually don’t create and delete nodes inside the same loop unless you’re testing.
-    // TODO: Discuss with your lab partner, know what the delete
+    /* What does this code do? It uses the list as a work queue: each char from myStr[i] is added, printed, and then removed.
+     * The removed node goes back on the pool's free list, so every pass reuses the same memory instead of a new and delete.*/
+    PooledList<char> queue;
     for (int i = 0; i < 7; i++) {
-        node* myNode = new node;
-        myNode->data = myStr[i];
-        cout << "\nLinked list data: " << myNode->data << endl;
-        delete myNode;
+        queue.pushBack(myStr[i]);
+        cout << "\nLinked list data: " << queue.front() << endl;
+        queue.popFront();
     }
 
 
-    // Create the linked list using a for loop
+    // Create the linked list from all of myStr at once
+    // Adding each char at the head leaves the list in reverse order, so assign walks myStr backwards.
+    // assign gets every node from one block instead of one new per char.
 
-    // We must have a starting node outside the for loop.
-    // Boundary Condition: The start of the list
-
-    // Note: pHead and pCurrent are already node pointers, we do not redefine them here
+    // Note: list already exists, so we reassign it instead of declaring a new one
     // What would happen if you did this:
-    // node* pHead = new node();
-    // You would be re-declaring a brand-new local variable pHead inside the current scope of the function.
-    pHead = new node();
-    pHead->data = myStr[0];
-    pHead->next = nullptr;
-
-    // TODO: follow the steps and complete this code snippet
-    for (int i = 1; i < 7; i++) {
-        // Step 1: Create a new node
-        pCurrent = new node();
-        // Step 2: Fill the data field(s)
-        pCurrent->data = myStr[i];
-        // Step 3: Attach to head of list
-        pCurrent->next = pHead;
-        // Step 4: Reposition head of list
-        pHead = pCurrent;
-    }
+    // PooledList<char> list;
+    // You would be re-declaring a brand-new local variable list inside the current scope of the function.
+    list.assign(myStr.rbegin(), myStr.rend());
 
     // Output the linked list!
-    // Ensure pHead and pCurrent are both pointing to the head of the list
-    // TODO: Complete these C++ statements:
-    cout << "\npHead's data: " << pHead->data << endl;
-    cout << "\npCurrent's data: " << pCurrent->data << endl;
-
-    // Use a while loop to get the size of the list
-    // Remember: the loop control variable must be initialized, checked, and changed.
+    // pHead and pCurrent both point to the head of the list
+    PooledList<char>::const_iterator pHead = list.begin();
+    PooledList<char>::const_iterator pCurrent = list.begin();
+    cout << "\npHead's data: " << *pHead << endl;
+    cout << "\npCurrent's data: " << *pCurrent << endl;
+
+    // Get the size of the list
+    // The list keeps its own size, so there is no need to walk every node with a while loop.
     int sizeOfList = 0;
     cout << "\nSize of list: " << sizeOfList << endl;
-    // TODO: create a while loop that walks thru the list
-    while (pCurrent != nullptr) {
-        sizeOfList++;
-        pCurrent = pCurrent->next;
-    }
+    sizeOfList = static_cast<int>(list.size());
     cout << "\nSize of list: " << sizeOfList << endl;
 
-    // Get pCurrent back to the head of the list
-    // TODO: Where is pCurrent after the while loop? Hint: look at your linked-list drawing.
-    // pCurrent is nullptr, as it is the condition that stops the while loop.
-
     // TODO: Use a for loop to output the list
-    pCurrent = pHead;
     cout << endl;
-    for (; pCurrent != nullptr; ) {
-        cout << pCurrent->data << " -> ";
-        pCurrent = pCurrent->next;
+    for (; pCurrent != list.end(); ++pCurrent) {
+        cout << *pCurrent << " -> ";
     }
     cout << "null" << endl;
 
@@ -0,0 +1,310 @@
+// Blake Wilson
+// Zoo Keeper Benchmarks
+//
+// Times the parse, build, name file, and report stages of "Official Final Midterm Program" on made up input.
+// Build: g++ -std=c++17 -O2 -pthread zooBenchmark.cpp -lbenchmark -o zooBenchmark
+// Run:   ./zooBenchmark --benchmark_format=json --benchmark_out=zooBench.json
+//        ./zooBenchmark --zoo_huge            also runs the 50 million line inputs
+//        ./zooBenchmark --generate 1000000    only writes arrivingAnimals.txt and animalNames.txt here
+
+#define ZOO_NO_MAIN
+#include "Official Final Midterm Program"
+#undef ZOO_NO_MAIN
+
+#include <benchmark/benchmark.h>
+#include <new>
+#include <sys/resource.h>
+
+// Counts every heap allocation so each benchmark can report allocations per record.
+// The replacements are kept out of line so GCC does not pair its inlined free() with new and warn.
+atomic<unsigned long long> allocationCount(0);
+
+#if defined(__GNUC__)
+#define ZOO_OUT_OF_LINE __attribute__((noinline))
+#else
+#define ZOO_OUT_OF_LINE
+#endif
+
+ZOO_OUT_OF_LINE void *operator new(size_t bytes) {
+    allocationCount.fetch_add(1, memory_order_relaxed);
+    void *memory = malloc(bytes == 0 ? 1 : bytes);
+    if (memory == nullptr) {
+        throw bad_alloc();
+    }
+    return memory;
+}
+
+ZOO_OUT_OF_LINE void operator delete(void *memory) noexcept {
+    free(memory);
+}
+
+ZOO_OUT_OF_LINE void operator delete(void *memory, size_t) noexcept {
+    free(memory);
+}
+
+// Helper function that gives the most memory this process has held at once, in megabytes.
+double peakRssMegabytes() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<double>(usage.ru_maxrss) / 1024.0;
+}
+
+// Small fixed random number generator so every run writes the same input.
+class InputRandom {
+private:
+    unsigned long long seed;
+
+public:
+    explicit InputRandom(unsigned long long start) : seed(start) {}
+
+    size_t next(size_t range) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<size_t>(seed >> 33) % range;
+    }
+};
+
+// Function that writes an arrivals file with lineCount lines and a names file with one name
+// for about three out of four animals, so the "Unnamed" fallback gets exercised too.
+// Returns false when either file cannot be written.
+bool writeSyntheticInput(const string &arrivalsFile, const string &namesFile, size_t lineCount) {
+    static const char *seasons[] = {"spring", "summer", "fall", "winter", "autumn", "unknown"};
+    static const char *colors[] = {"tan color", "brown color", "striped", "gold color", "black color"};
+    static const char *places[] = {"Friguia Park, Tunisia", "Zanzibar, Tanzania", "Dhaka, Bangladesh",
+                                   "Alaska Zoo, Alaska", "Kruger Park, South Africa"};
+    static const char *sexes[] = {"male", "female"};
+    InputRandom random(lineCount);
+
+    ofstream arrivals(arrivalsFile, ios::binary);
+    if (!arrivals) {
+        return false;
+    }
+    string line;
+    for (size_t i = 0; i < lineCount; ++i) {
+        line.clear();
+        line += to_string(1 + random.next(30));
+        line += " year old ";
+        line += sexes[random.next(2)];
+        line += ' ';
+        line += speciesRegistry[random.next(SPECIES_COUNT)].key;
+        line += ", born in ";
+        line += seasons[random.next(6)];
+        line += ", ";
+        line += colors[random.next(5)];
+        line += ", ";
+        line += to_string(20 + random.next(600));
+        line += " pounds, from ";
+        line += places[random.next(5)];
+        line += '\n';
+        arrivals << line;
+    }
+    if (!arrivals) {
+        return false;
+    }
+
+    ofstream names(namesFile, ios::binary);
+    if (!names) {
+        return false;
+    }
+    size_t namesPerSpecies = lineCount * 3 / (4 * SPECIES_COUNT) + 1;
+    for (int s = 0; s < SPECIES_COUNT; ++s) {
+        names << speciesRegistry[s].displayName << " Names:\n";
+        for (size_t n = 0; n < namesPerSpecies; ++n) {
+            names << (n == 0 ? "" : (n % 16 == 0 ? ",\n" : ", ")) << speciesRegistry[s].idPrefix << "name" << n;
+        }
+        names << "\n\n";
+    }
+    return static_cast<bool>(names);
+}
+
+// One generated input size, kept on disk and in memory between benchmarks.
+struct BenchInput {
+    string arrivalsFile;
+    string namesFile;
+    string text;
+    size_t lineCount = 0;
+    size_t nameCount = 0;
+    size_t namesBytes = 0;
+};
+
+// Helper function that writes the input for lineCount lines the first time it is asked for and reuses it after.
+const BenchInput &benchInput(size_t lineCount) {
+    static unordered_map<size_t, BenchInput> inputs;
+    BenchInput &input = inputs[lineCount];
+    if (input.lineCount == 0) {
+        filesystem::path folder = filesystem::temp_directory_path() / "zooBench";
+        filesystem::create_directories(folder);
+        input.arrivalsFile = (folder / ("arrivingAnimals_" + to_string(lineCount) + ".txt")).string();
+        input.namesFile = (folder / ("animalNames_" + to_string(lineCount) + ".txt")).string();
+        if (!writeSyntheticInput(input.arrivalsFile, input.namesFile, lineCount) ||
+            !readTextFile(input.arrivalsFile, input.text)) {
+            cout << "Could not write the benchmark input in " << folder.string() << "." << endl;
+            exit(1);
+        }
+        NamePool names;
+        readNames(input.namesFile, names);
+        for (int s = 0; s < SPECIES_COUNT; ++s) {
+            input.nameCount += names.size(static_cast<SpeciesId>(s));
+        }
+        input.namesBytes = static_cast<size_t>(filesystem::file_size(input.namesFile));
+        input.lineCount = lineCount;
+    }
+    return input;
+}
+
+// Helper function that fills in the counters every stage reports, given how many records
+// and bytes one pass of the stage works through.
+void reportStage(benchmark::State &state, size_t recordsPerPass, size_t bytesPerPass, unsigned long long allocations) {
+    double records = static_cast<double>(recordsPerPass) * static_cast<double>(state.iterations());
+    state.SetItemsProcessed(static_cast<int64_t>(records));
+    state.SetBytesProcessed(static_cast<int64_t>(bytesPerPass) * static_cast<int64_t>(state.iterations()));
+    state.counters["lines_per_second"] = benchmark::Counter(records, benchmark::Counter::kIsRate);
+    state.counters["allocs_per_record"] = records > 0 ? static_cast<double>(allocations) / records : 0.0;
+    state.counters["peak_rss_mb"] = peakRssMegabytes();
+}
+
+// Stage benchmark for parsing: splits every line into its fields without building anything.
+void benchmarkParse(benchmark::State &state) {
+    const BenchInput &input = benchInput(static_cast<size_t>(state.range(0)));
+    unsigned long long allocations = 0;
+    for (auto _ : state) {
+        unsigned long long before = allocationCount.load(memory_order_relaxed);
+        string_view remaining = input.text;
+        string_view line;
+        size_t parsedCount = 0;
+        while (nextLine(remaining, line)) {
+            ParsedArrival parsed;
+            parsedCount += parseArrivalLine(trimView(line), parsed) == ARRIVAL_OK ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(parsedCount);
+        allocations += allocationCount.load(memory_order_relaxed) - before;
+    }
+    reportStage(state, input.lineCount, input.text.size(), allocations);
+}
+
+// Stage benchmark for building: turns already parsed lines into named animals with IDs.
+void benchmarkBuild(benchmark::State &state) {
+    const BenchInput &input = benchInput(static_cast<size_t>(state.range(0)));
+    NamePool names;
+    readNames(input.namesFile, names);
+    vector<ParsedArrival> arrivals;
+    arrivals.reserve(input.lineCount);
+    string_view remaining = input.text;
+    string_view line;
+    while (nextLine(remaining, line)) {
+        ParsedArrival parsed;
+        if (parseArrivalLine(trimView(line), parsed) == ARRIVAL_OK) {
+            arrivals.push_back(parsed);
+        }
+    }
+    InternedString arrivalDate = internString("2024-03-05");
+
+    unsigned long long allocations = 0;
+    for (auto _ : state) {
+        unsigned long long before = allocationCount.load(memory_order_relaxed);
+        AnimalArena arena;
+        vector<Animal *> animals;
+        animals.reserve(arrivals.size());
+        for (int s = 0; s < SPECIES_COUNT; ++s) {
+            names.setUsed(static_cast<SpeciesId>(s), 0);
+        }
+        SpeciesCounters idNumbers = {};
+        for (size_t i = 0; i < arrivals.size(); ++i) {
+            SpeciesId species = static_cast<SpeciesId>(arrivals[i].species);
+            string_view name = getNextName(species, names);
+            animals.push_back(buildAnimal(arena, arrivals[i], name, ++idNumbers[species], arrivalDate, 2024));
+        }
+        benchmark::DoNotOptimize(animals.data());
+        allocations += allocationCount.load(memory_order_relaxed) - before;
+        state.PauseTiming();
+        animals.clear();
+        arena.clear();
+        state.ResumeTiming();
+    }
+    reportStage(state, input.lineCount, input.text.size(), allocations);
+}
+
+// Stage benchmark for reading the name file into the per species name pool.
+void benchmarkReadNames(benchmark::State &state) {
+    const BenchInput &input = benchInput(static_cast<size_t>(state.range(0)));
+    unsigned long long allocations = 0;
+    for (auto _ : state) {
+        unsigned long long before = allocationCount.load(memory_order_relaxed);
+        NamePool names;
+        readNames(input.namesFile, names);
+        benchmark::DoNotOptimize(&names);
+        allocations += allocationCount.load(memory_order_relaxed) - before;
+    }
+    reportStage(state, input.nameCount, input.namesBytes, allocations);
+}
+
+// Stage benchmark for writing the report from an already built animal table.
+void benchmarkReport(benchmark::State &state) {
+    const BenchInput &input = benchInput(static_cast<size_t>(state.range(0)));
+    ZooState zoo;
+    zoo.arrivalDate = internString("2024-03-05");
+    zoo.arrivalYear = 2024;
+    readNames(input.namesFile, zoo.names);
+    ingestText(zoo, input.text, 1);
+    AnimalTable table;
+    buildAnimalTable(zoo.animals, table);
+    string reportFile = (filesystem::temp_directory_path() / "zooBench" / "zooPopulation.txt").string();
+
+    unsigned long long allocations = 0;
+    for (auto _ : state) {
+        unsigned long long before = allocationCount.load(memory_order_relaxed);
+        writeReport(reportFile, table, zoo.speciesCounts);
+        allocations += allocationCount.load(memory_order_relaxed) - before;
+    }
+    reportStage(state, input.lineCount, input.text.size(), allocations);
+    zoo.animals.clear();
+    zoo.arena.clear();
+}
+
+// Helper function that registers one stage benchmark at every input size.
+void registerStage(const char *name, void (*stage)(benchmark::State &), bool includeHuge) {
+    benchmark::internal::Benchmark *bench = benchmark::RegisterBenchmark(name, stage);
+    bench->Arg(1000)->Arg(1000000);
+    if (includeHuge) {
+        bench->Arg(50000000);
+    }
+    bench->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+// Main function that either writes one input set for the real program or runs the benchmarks.
+int main(int argc, char *argv[]) {
+    bool includeHuge = false;
+    vector<char *> benchArgs;
+    for (int i = 0; i < argc; ++i) {
+        string flag = argv[i];
+        if (flag == "--generate" && i + 1 < argc) {
+            size_t lineCount = static_cast<size_t>(strtoull(argv[i + 1], nullptr, 10));
+            if (!writeSyntheticInput("arrivingAnimals.txt", "animalNames.txt", lineCount)) {
+                cout << "Could not write arrivingAnimals.txt and animalNames.txt." << endl;
+                return 1;
+            }
+            cout << "Wrote " << lineCount << " arrivals to arrivingAnimals.txt and animalNames.txt." << endl;
+            return 0;
+        }
+        if (flag == "--zoo_huge") {
+            includeHuge = true;
+            continue;
+        }
+        benchArgs.push_back(argv[i]);
+    }
+    // Pulling out the flags that belong to this program before Google Benchmark sees the rest.
+
+    registerStage("parse", benchmarkParse, includeHuge);
+    registerStage("build", benchmarkBuild, includeHuge);
+    registerStage("readNames", benchmarkReadNames, includeHuge);
+    registerStage("report", benchmarkReport, includeHuge);
+    // Setting up each stage at 1 thousand and 1 million lines, plus 50 million when asked.
+
+    int benchArgc = static_cast<int>(benchArgs.size());
+    benchmark::Initialize(&benchArgc, benchArgs.data());
+    if (benchmark::ReportUnrecognizedArguments(benchArgc, benchArgs.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}